@@ -7,12 +7,24 @@
 //   2. Make sure your .Build.cs includes "Core" in PrivateDependencyModuleNames.
 //   3. Compile, then open Window → Test Automation in the Editor.
 //   4. Filter for "UnrealMath.Transforms" to find these tests.
+//   5. Headless / CI run:
+//        UnrealEditor-Cmd.exe <Project>.uproject -unattended -nullrhi
+//          -ExecCmds="Automation RunTests UnrealMath.Transforms; Quit"
+//      Stress.Invariants is registered under the Stress filter, which the
+//      default run skips. Run it on its own, scaled up:
+//        UnrealEditor-Cmd.exe <Project>.uproject -unattended -nullrhi
+//          -ExecCmds="Automation SetFilter Stress; Automation RunTests UnrealMath.Transforms.Stress; Quit"
+//          -TransformStressSamples=10000000
+//      It shards its samples across every core.
 //
-// Only depends on CoreMinimal.h — no gameplay classes, no world, no actors.
+// Only depends on the Core module — no gameplay classes, no world, no actors.
 // ------------------------------------------------------------------
 
 #include "CoreMinimal.h"
+#include "Async/ParallelFor.h"
+#include "Math/RotationMatrix.h"
 #include "Misc/AutomationTest.h"
+#include "Misc/CommandLine.h"
 
 #if WITH_AUTOMATION_TESTS
 
@@ -30,6 +42,59 @@ namespace TransformTestHelpers
     {
         return A.Equals(B, Tol);
     }
+
+    /** One position packed with the layouts of FPackedPositions (notes/networking/PositionQuantization.md). */
+    struct FPackedCell
+    {
+        uint16 Planes16[3] = {};   // 16 bits: one entry from each of the X, Y and Z planes
+        uint64 Word = 0;           // 21 and 24 bits
+        uint8 HighZ = 0;           // 24 bits: Z code bits 16-23
+    };
+
+    /** Mirrors FPackedPositions::Encode for a single position. */
+    static FPackedCell PackCellCodes(int32 Bits, uint64 X, uint64 Y, uint64 Z)
+    {
+        FPackedCell Packed;
+        if (Bits == 16)
+        {
+            Packed.Planes16[0] = (uint16)X;
+            Packed.Planes16[1] = (uint16)Y;
+            Packed.Planes16[2] = (uint16)Z;
+        }
+        else
+        {
+            const uint32 Shift = (uint32)Bits;
+            Packed.Word = X | (Y << Shift) | (Z << (2 * Shift));   // for 24 bits, Z's top byte shifts out
+            if (Bits == 24)
+            {
+                Packed.HighZ = (uint8)(Z >> 16);
+            }
+        }
+        return Packed;
+    }
+
+    /** Mirrors FPackedPositions::Decode<T> for a single position, relative to the cell origin. */
+    template <typename T>
+    static UE::Math::TVector<T> UnpackCellCodes(int32 Bits, const FPackedCell& Packed, const FVector& Step)
+    {
+        const T StepX = (T)Step.X, StepY = (T)Step.Y, StepZ = (T)Step.Z;
+        if (Bits == 16)
+        {
+            return UE::Math::TVector<T>(
+                (T)(int32)Packed.Planes16[0] * StepX,
+                (T)(int32)Packed.Planes16[1] * StepY,
+                (T)(int32)Packed.Planes16[2] * StepZ);
+        }
+
+        const uint64 Mask = (1ull << Bits) - 1;
+        const uint64 CodeZ = Bits == 24
+            ? (Packed.Word >> 48) | ((uint64)Packed.HighZ << 16)
+            : Packed.Word >> 42;
+        return UE::Math::TVector<T>(
+            (T)(int32)(Packed.Word & Mask) * StepX,
+            (T)(int32)((Packed.Word >> Bits) & Mask) * StepY,
+            (T)(int32)CodeZ * StepZ);
+    }
 }
 
 // ===================================================================
@@ -208,6 +273,63 @@ bool FVectorInterpolation::RunTest(const FString& Parameters)
     return true;
 }
 
+// --------------- Cell Quantization ---------------
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+    FVectorCellQuantization,
+    "UnrealMath.Transforms.FVector.CellQuantization",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FVectorCellQuantization::RunTest(const FString& Parameters)
+{
+    using namespace TransformTestHelpers;
+
+    // Cell-relative codes round to the nearest step, so the error is at most half a step per axis.
+    // A cell edge of 2 × Tolerance × (2^Bits - 1) is the largest that stays within Tolerance; test just under it.
+    // Codes go through the packed layouts, so the 21-bit word and the 24-bit HighZ split are covered too.
+    FRandomStream Stream(97);
+    for (const int32 Bits : { 16, 21, 24 })
+    {
+        const int64 MaxCode = (1ll << Bits) - 1;
+        const double CellSize = 0.95 * 2.0 * Tolerance * (double)MaxCode;
+        const FBox Cell(FVector(-3.0e5, 1.0e5, -2.0e3), FVector(-3.0e5, 1.0e5, -2.0e3) + CellSize);
+        const FVector Step = Cell.GetSize() / (double)MaxCode;
+
+        // Float decode rounds twice, Step to float and then the product, each by at most CellSize × 2^-24
+        const double FloatTolerance = 0.5 * Step.GetMax() + 2.0 * CellSize * FMath::Pow(2.0, -24.0);
+
+        bool bCodesRoundTrip = true;
+        bool bWithinTolerance = true;
+        bool bFloatWithinTolerance = true;
+        for (int32 Sample = 0; Sample < 1000; ++Sample)
+        {
+            // Every fifth sample sits on the top corner, so all code bits are set
+            const FVector Position = Sample % 5 == 0
+                ? Cell.Max
+                : Cell.Min + FVector(Stream.FRand(), Stream.FRand(), Stream.FRand()) * Cell.GetSize();
+            uint64 Codes[3];
+            for (int32 Axis = 0; Axis < 3; ++Axis)
+            {
+                const int64 Code = FMath::RoundToInt64((Position[Axis] - Cell.Min[Axis]) / Step[Axis]);
+                Codes[Axis] = (uint64)FMath::Clamp<int64>(Code, 0, MaxCode);
+            }
+
+            const FPackedCell Packed = PackCellCodes(Bits, Codes[0], Codes[1], Codes[2]);
+            const FVector Decoded = UnpackCellCodes<double>(Bits, Packed, Step);
+            bCodesRoundTrip &= Decoded.Equals(FVector((double)Codes[0], (double)Codes[1], (double)Codes[2]) * Step, 0.0);
+            bWithinTolerance &= VectorsNearlyEqual(Cell.Min + Decoded, Position);
+
+            const FVector3f Local = UnpackCellCodes<float>(Bits, Packed, Step);
+            bFloatWithinTolerance &= VectorsNearlyEqual(FVector(Local), Position - Cell.Min, FloatTolerance);
+        }
+        TestTrue(FString::Printf(TEXT("%d-bit codes survive packing"), Bits), bCodesRoundTrip);
+        TestTrue(FString::Printf(TEXT("%d-bit decode within Tolerance"), Bits), bWithinTolerance);
+        TestTrue(FString::Printf(TEXT("%d-bit float decode within half a step + CellSize x 2^-23"), Bits), bFloatWithinTolerance);
+    }
+
+    return true;
+}
+
 // ===================================================================
 //  FRotator Tests
 // ===================================================================
@@ -330,6 +452,60 @@ bool FRotatorDirectionVector::RunTest(const FString& Parameters)
     return true;
 }
 
+// --------------- Axes ---------------
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+    FRotatorAxes,
+    "UnrealMath.Transforms.FRotator.Axes",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FRotatorAxes::RunTest(const FString& Parameters)
+{
+    using namespace TransformTestHelpers;
+
+    FRotator Rot(20.0, 60.0, 35.0);
+    FQuat Quat = Rot.Quaternion();
+
+    // One rotation matrix yields the same frame as the quaternion helpers
+    FVector Forward, Right, Up;
+    FRotationMatrix(Rot).GetUnitAxes(Forward, Right, Up);
+    TestTrue(TEXT("Forward matches GetForwardVector"), VectorsNearlyEqual(Forward, Quat.GetForwardVector()));
+    TestTrue(TEXT("Right matches GetRightVector"),     VectorsNearlyEqual(Right,   Quat.GetRightVector()));
+    TestTrue(TEXT("Up matches GetUpVector"),           VectorsNearlyEqual(Up,      Quat.GetUpVector()));
+
+    // Forward is also what Vector() returns
+    TestTrue(TEXT("Forward matches Vector()"), VectorsNearlyEqual(Forward, Rot.Vector()));
+
+    return true;
+}
+
+// --------------- Euler Convention ---------------
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+    FRotatorEulerConvention,
+    "UnrealMath.Transforms.FRotator.EulerConvention",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FRotatorEulerConvention::RunTest(const FString& Parameters)
+{
+    using namespace TransformTestHelpers;
+
+    // FRotator is extrinsic X-Y-Z with angles (-Roll, -Pitch, Yaw)
+    FRotator Rot(20.0, 60.0, 35.0);
+    FQuat Chained = FQuat(FVector::UpVector,      FMath::DegreesToRadians(Rot.Yaw))
+                  * FQuat(FVector::RightVector,   FMath::DegreesToRadians(-Rot.Pitch))
+                  * FQuat(FVector::ForwardVector, FMath::DegreesToRadians(-Rot.Roll));
+    TestTrue(TEXT("Quaternion matches Yaw * -Pitch * -Roll"), Rot.Quaternion().Equals(Chained, Tolerance));
+
+    // FQuat::Euler() is (Roll, Pitch, Yaw)
+    FVector Euler = Chained.Euler();
+    TestNearlyEqual(TEXT("Euler X is Roll"),  Euler.X, Rot.Roll,  Tolerance);
+    TestNearlyEqual(TEXT("Euler Y is Pitch"), Euler.Y, Rot.Pitch, Tolerance);
+    TestNearlyEqual(TEXT("Euler Z is Yaw"),   Euler.Z, Rot.Yaw,   Tolerance);
+
+    return true;
+}
+
 // ===================================================================
 //  FQuat Tests
 // ===================================================================
@@ -721,6 +897,59 @@ bool FTransformGetRelative::RunTest(const FString& Parameters)
     return true;
 }
 
+// --------------- Root Motion Delta ---------------
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+    FTransformRootMotionDelta,
+    "UnrealMath.Transforms.FTransform.RootMotionDelta",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FTransformRootMotionDelta::RunTest(const FString& Parameters)
+{
+    using namespace TransformTestHelpers;
+
+    // Two root keys 20 degrees apart across the +/-180 yaw seam, the second stored with either sign
+    const FTransform Previous(FQuat(FVector::UpVector, FMath::DegreesToRadians(170.0)), FVector(100.0, 0.0, 0.0));
+    const FQuat NextRotation(FVector::UpVector, FMath::DegreesToRadians(-170.0));
+    const FVector Step(10.0, 0.0, 5.0);
+
+    for (const FQuat& Next : { NextRotation, NextRotation * -1.0 })
+    {
+        const FTransform Current(Next, Previous.GetLocation() + Previous.GetRotation().RotateVector(Step));
+        const FTransform Delta = Current.GetRelativeTransform(Previous);
+
+        // Translation is expressed in the previous root's frame
+        TestTrue(TEXT("Delta translation in previous frame"), Delta.GetTranslation().Equals(Step, Tolerance));
+
+        // Forcing W >= 0 picks the short arc: +20 degrees, not -340
+        FQuat Rotation = Delta.GetRotation();
+        if (Rotation.W < 0.0)
+        {
+            Rotation = Rotation * -1.0;
+        }
+        TestTrue(TEXT("Shortest-arc delta yaw"),
+            FMath::IsNearlyEqual(FMath::RadiansToDegrees(2.0 * FMath::Atan2(Rotation.Z, Rotation.W)), 20.0, Tolerance));
+    }
+
+    // Yaw-only extraction: the twist about up discards pitch
+    const FQuat Tilted = FQuat(FVector::UpVector, FMath::DegreesToRadians(30.0)) * FQuat(FVector::RightVector, FMath::DegreesToRadians(15.0));
+    FQuat Swing, Twist;
+    Tilted.ToSwingTwist(FVector::UpVector, Swing, Twist);
+    TestTrue(TEXT("Twist is the yaw"), Twist.Equals(FQuat(FVector::UpVector, FMath::DegreesToRadians(30.0)), Tolerance));
+    TestTrue(TEXT("Swing * Twist reconstructs"), (Swing * Twist).Equals(Tilted, Tolerance));
+
+    // Accumulation: Actor = Delta * Actor applies the delta in the actor's current frame
+    const FTransform YawStep(FQuat(FVector::UpVector, FMath::DegreesToRadians(90.0)), Step);
+    FTransform Actor = FTransform::Identity;
+    Actor = YawStep * Actor;
+    Actor = YawStep * Actor;
+    TestTrue(TEXT("Accumulated location"), Actor.GetLocation().Equals(FVector(10.0, 10.0, 10.0), Tolerance));
+    TestTrue(TEXT("Accumulated rotation"),
+        Actor.GetRotation().Equals(FQuat(FVector::UpVector, FMath::DegreesToRadians(180.0)), Tolerance));
+
+    return true;
+}
+
 // --------------- Inverse ---------------
 
 IMPLEMENT_SIMPLE_AUTOMATION_TEST(
@@ -879,4 +1108,161 @@ bool FTransformRoundTrips::RunTest(const FString& Parameters)
     return true;
 }
 
+// ===================================================================
+//  Randomized Stress Tests
+// ===================================================================
+
+namespace TransformTestHelpers
+{
+    /** Samples per stress run. Override with -TransformStressSamples=<n>. */
+    static int32 GetStressSampleCount()
+    {
+        int32 Samples = 100000;
+        FParse::Value(FCommandLine::Get(), TEXT("TransformStressSamples="), Samples);
+        return FMath::Max(Samples, 1);
+    }
+
+    static FQuat RandomQuat(FRandomStream& Stream)
+    {
+        return FQuat(Stream.GetUnitVector(), Stream.FRandRange(-PI, PI));
+    }
+
+    /** Translation within 1000 units, positive scale in [0.5, 2]. */
+    static FTransform RandomTransform(FRandomStream& Stream, bool bUniformScale)
+    {
+        const FQuat Rotation = RandomQuat(Stream);
+        const FVector Translation = Stream.GetUnitVector() * Stream.FRandRange(0.0, 1000.0);
+        const FVector Scale = bUniformScale
+            ? FVector(Stream.FRandRange(0.5, 2.0))
+            : FVector(Stream.FRandRange(0.5, 2.0), Stream.FRandRange(0.5, 2.0), Stream.FRandRange(0.5, 2.0));
+        return FTransform(Rotation, Translation, Scale);
+    }
+
+    /** Component-wise compare; FQuat::Equals already treats Q and -Q as equal. */
+    static bool TransformsNearlyEqual(const FTransform& A, const FTransform& B, double Tol = Tolerance)
+    {
+        return A.GetTranslation().Equals(B.GetTranslation(), Tol)
+            && A.GetRotation().Equals(B.GetRotation(), Tol)
+            && A.GetScale3D().Equals(B.GetScale3D(), Tol);
+    }
+}
+
+// --------------- Invariants on Random Inputs ---------------
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+    FTransformStressInvariants,
+    "UnrealMath.Transforms.Stress.Invariants",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::StressFilter)
+
+bool FTransformStressInvariants::RunTest(const FString& Parameters)
+{
+    using namespace TransformTestHelpers;
+
+    struct FShardResult
+    {
+        int32 PositionRoundTrip = 0;
+        int32 InverseIdentity = 0;
+        int32 Associativity = 0;
+        int32 RotatorRoundTrip = 0;
+        int32 FirstFailure = INDEX_NONE;
+    };
+
+    const int32 NumSamples = GetStressSampleCount();
+    const int32 NumShards = FMath::Min(FPlatformMisc::NumberOfCoresIncludingHyperthreads(), NumSamples);
+    const int32 SamplesPerShard = FMath::DivideAndRoundUp(NumSamples, NumShards);
+
+    TArray<FShardResult> Results;
+    Results.SetNum(NumShards);
+
+    // Test* calls are not thread-safe, so shards only count failures.
+    ParallelFor(NumShards, [&](int32 Shard)
+    {
+        FShardResult& Result = Results[Shard];
+        const int32 Begin = Shard * SamplesPerShard;
+        const int32 End = FMath::Min(Begin + SamplesPerShard, NumSamples);
+
+        for (int32 Sample = Begin; Sample < End; ++Sample)
+        {
+            // Seeded per sample, so a failure reproduces from its index alone.
+            FRandomStream Stream((int32)((uint32)Sample * 2654435761u));
+            bool bFailed = false;
+
+            // Position round-trip holds for non-uniform scale too
+            {
+                const FTransform T = RandomTransform(Stream, false);
+                const FVector Local = Stream.GetUnitVector() * Stream.FRandRange(0.0, 1000.0);
+                if (!T.InverseTransformPosition(T.TransformPosition(Local)).Equals(Local, Tolerance))
+                {
+                    ++Result.PositionRoundTrip;
+                    bFailed = true;
+                }
+            }
+
+            // T * Inverse ≈ Identity (exact only for uniform scale)
+            {
+                const FTransform T = RandomTransform(Stream, true);
+                if (!TransformsNearlyEqual(T * T.Inverse(), FTransform::Identity))
+                {
+                    ++Result.InverseIdentity;
+                    bFailed = true;
+                }
+            }
+
+            // (A * B) * C ≈ A * (B * C) (non-uniform scale would introduce shear)
+            {
+                const FTransform A = RandomTransform(Stream, true);
+                const FTransform B = RandomTransform(Stream, true);
+                const FTransform C = RandomTransform(Stream, true);
+                if (!TransformsNearlyEqual((A * B) * C, A * (B * C)))
+                {
+                    ++Result.Associativity;
+                    bFailed = true;
+                }
+            }
+
+            // FQuat → FRotator → FQuat is the same rotation (pitch kept clear of gimbal lock)
+            {
+                const FQuat Q = FRotator(Stream.FRandRange(-89.0, 89.0),
+                                         Stream.FRandRange(-180.0, 180.0),
+                                         Stream.FRandRange(-180.0, 180.0)).Quaternion();
+                if (!Q.Rotator().Quaternion().Equals(Q, Tolerance))
+                {
+                    ++Result.RotatorRoundTrip;
+                    bFailed = true;
+                }
+            }
+
+            if (bFailed && Result.FirstFailure == INDEX_NONE)
+            {
+                Result.FirstFailure = Sample;
+            }
+        }
+    });
+
+    FShardResult Total;
+    for (const FShardResult& Result : Results)
+    {
+        Total.PositionRoundTrip += Result.PositionRoundTrip;
+        Total.InverseIdentity   += Result.InverseIdentity;
+        Total.Associativity     += Result.Associativity;
+        Total.RotatorRoundTrip  += Result.RotatorRoundTrip;
+        if (Total.FirstFailure == INDEX_NONE)
+        {
+            Total.FirstFailure = Result.FirstFailure;
+        }
+    }
+
+    TestEqual(TEXT("Position round-trip failures"), Total.PositionRoundTrip, 0);
+    TestEqual(TEXT("Inverse identity failures"),    Total.InverseIdentity,   0);
+    TestEqual(TEXT("Associativity failures"),       Total.Associativity,     0);
+    TestEqual(TEXT("Rotator round-trip failures"),  Total.RotatorRoundTrip,  0);
+
+    if (Total.FirstFailure != INDEX_NONE)
+    {
+        AddInfo(FString::Printf(TEXT("First failing sample: %d of %d"), Total.FirstFailure, NumSamples));
+    }
+
+    return true;
+}
+
 #endif // WITH_AUTOMATION_TESTS